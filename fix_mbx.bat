@@ -1,13 +1,18 @@
 @echo off
 rem Fix the UTF-8 characters and other problems in one Eudora mailbox using Eudora_fix_mbx,
-rem and maintain a series of backup files. 
+rem and maintain a series of undo journals. 
 
 rem The mailbox name is the first argument; if not provided we ask for it.
 rem The name of the translation file can be specified as the optional second argument.
 rem The name of the log file can be specified as the optional third argument.
 rem If any of the arguments contain embedded blanks, enclose it in quotes.
 
-rem This batch file version is from 13 Feb 2022 at 5:57pm needs Eudora_fix_mbx version 1.3 or higher.
+rem This batch file version is from 17 Oct 2026 and needs Eudora_fix_mbx version 1.7 or higher.
+
+rem Instead of copying the whole mailbox and TOC files before each run, we have the program
+rem record the original bytes of everything it changes in an undo journal, which is much smaller.
+rem To undo a run, do this with Eudora stopped, undoing the newest runs first (1, then 2, etc.):
+rem    Eudora_fix_mbx -undo=mailboxname.1.undo mailboxname
 
 if "%~2"=="" (set xlatefile="translations.txt") else (set xlatefile="%~2")
 if "%~3"=="" (set logfile="Eudora_fix_mbx.log") else (set logfile="%~3")
@@ -31,39 +36,35 @@ if "%last4%"==".MBX" set mbxname=%mbxname:~0,-5%"
 rem extract just the filename part (with surrounding quotes) for the later rename commands
 call :setfilename %mbxname%
 
-rem temporarily create the newest backups with the number 0 in the name
-if exist %mbxname%.mbx copy /b %mbxname%.mbx %mbxname%.mbx.0.bak
-if exist %mbxname%.toc copy /b %mbxname%.toc %mbxname%.toc.0.bak
+rem the newest undo journal temporarily has the number 0 in the name
+if exist %mbxname%.0.undo del %mbxname%.0.undo
 
 rem fix the mailbox and TOC files, which also adds to the log
 echo. >>%logfile%
-Eudora_fix_mbx -l=%logfile% -t=%xlatefile% %mbxname%
+Eudora_fix_mbx -l=%logfile% -t=%xlatefile% -j=%mbxname%.0.undo %mbxname%
 set /a returnval=%ERRORLEVEL%
 rem errorlevel is 0 for "made changes", 1 for "made no changes", 
 rem   8 for "fatal error with no changes made", 12 for "fatal error with changes"
 IF %returnval% EQU 0 goto keepbackup
 IF %returnval% GTR 1 pause
 if %returnval% GTR 8 goto keepbackup
-rem no changes were made, or there was an error with no changes: delete the new backups
-if exist %mbxname%.mbx.0.bak del %mbxname%.mbx.0.bak
-if exist %mbxname%.toc.0.bak del %mbxname%.toc.0.bak
-echo no changes were made, so the new backup of mailbox %mbxname% was removed
+rem no changes were made, or there was an error with no changes: delete the new journal
+if exist %mbxname%.0.undo del %mbxname%.0.undo
+echo no changes were made, so the new undo journal of mailbox %mbxname% was removed
 goto :truncatelog
 
 :keepbackup
-rem first remove the oldest backup -- the one with the highest number
-if exist %mbxname%.mbx.%numbackups%.bak del %mbxname%.mbx.%numbackups%.bak
-if exist %mbxname%.toc.%numbackups%.bak del %mbxname%.toc.%numbackups%.bak
-if exist %mbxname%.mbx.0.bak echo a backup of mailbox %mbxname% was kept
-rem now rename the remaining backups, so the newest is 1 and the oldest has the highest number
+rem first remove the oldest journal -- the one with the highest number
+if exist %mbxname%.%numbackups%.undo del %mbxname%.%numbackups%.undo
+if exist %mbxname%.0.undo echo an undo journal of mailbox %mbxname% was kept
+rem now rename the remaining journals, so the newest is 1 and the oldest has the highest number
 SETLOCAL EnableDelayedExpansion
 for /L %%x in (%numbackups%,-1,1)do (
  set /a xminus1=%%x-1
- if exist %mbxname%.mbx.!xminus1!.bak ren %mbxname%.mbx.!xminus1!.bak %filename%.mbx.%%x.bak
- if exist %mbxname%.toc.!xminus1!.bak ren %mbxname%.toc.!xminus1!.bak %filename%.toc.%%x.bak
+ if exist %mbxname%.!xminus1!.undo ren %mbxname%.!xminus1!.undo %filename%.%%x.undo
  )
-rem make a log entry that lists all the backups
-echo mailbox %mbxname% backups as of %date% at %time% >>%logfile%
+rem make a log entry that lists all the journals
+echo mailbox %mbxname% undo journals as of %date% at %time% >>%logfile%
   rem (the "more" below removes the first 5 useless lines of the directory list)
 dir /OD %mbxname%.* | more +5 >>%logfile%
 